@@ -6,6 +6,8 @@
 C_UPPER_SRCS += \
 ../common.C \
 ../cppsp_cpoll.C \
+../headercontainer.C \
+../httpparser.C \
 ../page.C \
 ../stringutils.C \
 ../websocket.C 
@@ -13,6 +15,8 @@ C_UPPER_SRCS += \
 OBJS += \
 ./common.o \
 ./cppsp_cpoll.o \
+./headercontainer.o \
+./httpparser.o \
 ./page.o \
 ./stringutils.o \
 ./websocket.o 
@@ -20,6 +24,8 @@ OBJS += \
 C_UPPER_DEPS += \
 ./common.d \
 ./cppsp_cpoll.d \
+./headercontainer.d \
+./httpparser.d \
 ./page.d \
 ./stringutils.d \
 ./websocket.d 
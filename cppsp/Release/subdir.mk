@@ -6,18 +6,24 @@
 C_UPPER_SRCS += \
 ../common.C \
 ../cppsp_cpoll.C \
+../headercontainer.C \
+../httpparser.C \
 ../page.C \
 ../stringutils.C 
 
 OBJS += \
 ./common.o \
 ./cppsp_cpoll.o \
+./headercontainer.o \
+./httpparser.o \
 ./page.o \
 ./stringutils.o 
 
 C_UPPER_DEPS += \
 ./common.d \
 ./cppsp_cpoll.d \
+./headercontainer.d \
+./httpparser.d \
 ./page.d \
 ./stringutils.d 
 